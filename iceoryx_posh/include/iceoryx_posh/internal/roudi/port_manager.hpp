@@ -96,6 +96,8 @@ class PortManager
     void deletePortsOfProcess(const ProcessName_t& processName) noexcept;
 
     const std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
+
+    const runtime::ServiceRegistryData* serviceRegistryData() noexcept;
     runtime::IpcMessage findService(const capro::ServiceDescription& service) noexcept;
 
   protected:
@@ -25,47 +25,149 @@
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
-#include "iceoryx_utils/cxx/optional.hpp"
-#include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_data.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
 
 namespace iox
 {
 namespace roudi
 {
-/// @brief workaround container until we have a fixed list with the needed functionality
+/// @brief Container which keeps its elements at a fixed memory position. The occupied slots are tracked with a
+///        bitmap and the free slots with a stack of indices, therefore insert and erase are O(1) and the iteration
+///        skips blocks of 64 empty slots at once.
+///        - the iteration is in ascending slot order; a fresh container fills the slots in ascending order, but
+///          afterwards insert reuses the most recently erased slot first (LIFO) and not the lowest free one
+///        - erasing the element an iterator points to is allowed during the iteration, since the next occupied
+///          slot is looked up on increment
+///        - an element which is inserted during the iteration is visited in the same iteration if its slot is
+///          behind the current position of the iterator, otherwise it is not visited
 template <typename T, uint64_t Capacity>
 class FixedPositionContainer
 {
+  private:
+    static constexpr uint64_t BITS_PER_WORD = 64U;
+    static constexpr uint64_t NUMBER_OF_WORDS = (Capacity + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+
+    /// @brief smallest unsigned type which can store all slot indices
+    using index_t = typename std::conditional<
+        (Capacity <= std::numeric_limits<uint8_t>::max()),
+        uint8_t,
+        typename std::conditional<(Capacity <= std::numeric_limits<uint16_t>::max()),
+                                  uint16_t,
+                                  typename std::conditional<(Capacity <= std::numeric_limits<uint32_t>::max()),
+                                                            uint32_t,
+                                                            uint64_t>::type>::type>::type;
+
   public:
     static constexpr uint64_t FIRST_ELEMENT = std::numeric_limits<uint64_t>::max();
 
-    bool hasFreeSpace();
+    /// @brief iterator over the occupied slots; dereferencing returns the pointer to the element by value, therefore
+    ///        it is classified as input iterator although it supports multiple passes
+    class Iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T* const*;
+        using reference = T*;
+
+        Iterator(FixedPositionContainer* container, const uint64_t index) noexcept;
+
+        T* operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        Iterator operator++(int) noexcept;
+        bool operator==(const Iterator& rhs) const noexcept;
+        bool operator!=(const Iterator& rhs) const noexcept;
+
+      private:
+        FixedPositionContainer* m_container;
+        uint64_t m_index;
+    };
+
+    /// @brief iteration-only view of the container, the elements can be accessed but not inserted or erased
+    class View
+    {
+      public:
+        explicit View(FixedPositionContainer& container) noexcept;
+
+        Iterator begin() const noexcept;
+        Iterator end() const noexcept;
+        uint64_t size() const noexcept;
+
+      private:
+        FixedPositionContainer* m_container;
+    };
+
+    FixedPositionContainer() noexcept;
+    ~FixedPositionContainer() noexcept;
+
+    FixedPositionContainer(const FixedPositionContainer&) = delete;
+    FixedPositionContainer(FixedPositionContainer&&) = delete;
+    FixedPositionContainer& operator=(const FixedPositionContainer&) = delete;
+    FixedPositionContainer& operator=(FixedPositionContainer&&) = delete;
+
+    bool hasFreeSpace() const noexcept;
 
     template <typename... Targs>
     T* insert(Targs&&... args);
 
-    void erase(T* const element);
+    void erase(T* const element) noexcept;
+
+    uint64_t size() const noexcept;
+
+    Iterator begin() noexcept;
+    Iterator end() noexcept;
 
-    cxx::vector<T*, Capacity> content();
+    View view() noexcept;
 
   private:
-    cxx::vector<cxx::optional<T>, Capacity> m_data;
+    using element_t = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    /// @brief returns the index of the first occupied slot starting at index or Capacity if there is none
+    uint64_t findOccupiedSlot(const uint64_t index) const noexcept;
+    bool isOccupied(const uint64_t index) const noexcept;
+    T* elementAt(const uint64_t index) noexcept;
+
+    static uint64_t countTrailingZeros(const uint64_t value) noexcept;
+
+    element_t m_data[Capacity];
+    uint64_t m_occupancy[NUMBER_OF_WORDS];
+    index_t m_freeIndices[Capacity];
+    uint64_t m_numberOfFreeIndices{Capacity};
 };
 
 struct PortPoolData
 {
-    FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
-    FixedPositionContainer<popo::ApplicationPortData, MAX_PROCESS_NUMBER> m_applicationPortMembers;
-    FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
-    FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableMembers;
-    FixedPositionContainer<popo::EventVariableData, MAX_NUMBER_OF_EVENT_VARIABLES> m_eventVariableMembers;
+    using InterfaceContainer = FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER>;
+    using ApplicationContainer = FixedPositionContainer<popo::ApplicationPortData, MAX_PROCESS_NUMBER>;
+    using NodeContainer = FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER>;
+    using ConditionVariableContainer =
+        FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES>;
+    using EventVariableContainer = FixedPositionContainer<popo::EventVariableData, MAX_NUMBER_OF_EVENT_VARIABLES>;
+    using PublisherContainer = FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS>;
+    using SubscriberContainer = FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS>;
 
-    FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
-    FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    InterfaceContainer m_interfacePortMembers;
+    ApplicationContainer m_applicationPortMembers;
+    NodeContainer m_nodeMembers;
+    ConditionVariableContainer m_conditionVariableMembers;
+    EventVariableContainer m_eventVariableMembers;
+
+    PublisherContainer m_publisherPortMembers;
+    SubscriberContainer m_subscriberPortMembers;
 
     // required to be atomic since a service can be offered or stopOffered while reading
     // this variable in a user application
     std::atomic<uint64_t> m_serviceRegistryChangeCounter{0};
+
+    // read by the applications to find services without a request to RouDi
+    runtime::ServiceRegistryData m_serviceRegistryData;
 };
 
 } // namespace roudi
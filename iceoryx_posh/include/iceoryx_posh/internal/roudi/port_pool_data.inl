@@ -21,67 +21,216 @@ namespace iox
 namespace roudi
 {
 template <typename T, uint64_t Capacity>
-bool FixedPositionContainer<T, Capacity>::hasFreeSpace()
+constexpr uint64_t FixedPositionContainer<T, Capacity>::BITS_PER_WORD;
+
+template <typename T, uint64_t Capacity>
+constexpr uint64_t FixedPositionContainer<T, Capacity>::NUMBER_OF_WORDS;
+
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::Iterator::Iterator(FixedPositionContainer* container,
+                                                        const uint64_t index) noexcept
+    : m_container(container)
+    , m_index(index)
+{
+}
+
+template <typename T, uint64_t Capacity>
+T* FixedPositionContainer<T, Capacity>::Iterator::operator*() const noexcept
+{
+    return m_container->elementAt(m_index);
+}
+
+template <typename T, uint64_t Capacity>
+typename FixedPositionContainer<T, Capacity>::Iterator& FixedPositionContainer<T, Capacity>::Iterator::
+operator++() noexcept
+{
+    m_index = m_container->findOccupiedSlot(m_index + 1U);
+    return *this;
+}
+
+template <typename T, uint64_t Capacity>
+typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::Iterator::
+operator++(int) noexcept
+{
+    Iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+template <typename T, uint64_t Capacity>
+bool FixedPositionContainer<T, Capacity>::Iterator::operator==(const Iterator& rhs) const noexcept
+{
+    return m_container == rhs.m_container && m_index == rhs.m_index;
+}
+
+template <typename T, uint64_t Capacity>
+bool FixedPositionContainer<T, Capacity>::Iterator::operator!=(const Iterator& rhs) const noexcept
 {
-    if (m_data.capacity() > m_data.size())
+    return !(*this == rhs);
+}
+
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::View::View(FixedPositionContainer& container) noexcept
+    : m_container(&container)
+{
+}
+
+template <typename T, uint64_t Capacity>
+typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::View::begin() const
+    noexcept
+{
+    return m_container->begin();
+}
+
+template <typename T, uint64_t Capacity>
+typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::View::end() const
+    noexcept
+{
+    return m_container->end();
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::View::size() const noexcept
+{
+    return m_container->size();
+}
+
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::FixedPositionContainer() noexcept
+{
+    for (auto& word : m_occupancy)
     {
-        return true;
+        word = 0U;
     }
 
-    for (auto& e : m_data)
+    // the lowest index is on top of the stack, so that the slots are initially used in ascending order
+    for (uint64_t i = 0U; i < Capacity; ++i)
     {
-        if (!e.has_value())
-        {
-            return true;
-        }
+        m_freeIndices[i] = static_cast<index_t>(Capacity - 1U - i);
     }
+}
 
-    return false;
+template <typename T, uint64_t Capacity>
+FixedPositionContainer<T, Capacity>::~FixedPositionContainer() noexcept
+{
+    for (uint64_t i = findOccupiedSlot(0U); i < Capacity; i = findOccupiedSlot(i + 1U))
+    {
+        elementAt(i)->~T();
+    }
+}
+
+template <typename T, uint64_t Capacity>
+bool FixedPositionContainer<T, Capacity>::hasFreeSpace() const noexcept
+{
+    return m_numberOfFreeIndices > 0U;
 }
 
 template <typename T, uint64_t Capacity>
 template <typename... Targs>
 T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args)
 {
-    for (auto& e : m_data)
+    if (!hasFreeSpace())
     {
-        if (!e.has_value())
-        {
-            e.emplace(std::forward<Targs>(args)...);
-            return &e.value();
-        }
+        return nullptr;
     }
 
-    m_data.emplace_back();
-    m_data.back().emplace(std::forward<Targs>(args)...);
-    return &m_data.back().value();
+    const uint64_t index = m_freeIndices[--m_numberOfFreeIndices];
+    T* element = new (&m_data[index]) T(std::forward<Targs>(args)...);
+    m_occupancy[index / BITS_PER_WORD] |= (1ULL << (index % BITS_PER_WORD));
+    return element;
 }
 
 template <typename T, uint64_t Capacity>
-void FixedPositionContainer<T, Capacity>::erase(T* const element)
+void FixedPositionContainer<T, Capacity>::erase(T* const element) noexcept
 {
-    for (auto& e : m_data)
+    const auto address = reinterpret_cast<uintptr_t>(element);
+    const auto begin = reinterpret_cast<uintptr_t>(&m_data[0]);
+    if (address < begin || (address - begin) % sizeof(element_t) != 0U)
     {
-        if (e.has_value() && &e.value() == element)
-        {
-            e.reset();
-            return;
-        }
+        return;
+    }
+
+    const uint64_t index = (address - begin) / sizeof(element_t);
+    if (index >= Capacity || !isOccupied(index))
+    {
+        return;
     }
+
+    element->~T();
+    m_occupancy[index / BITS_PER_WORD] &= ~(1ULL << (index % BITS_PER_WORD));
+    m_freeIndices[m_numberOfFreeIndices++] = static_cast<index_t>(index);
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::size() const noexcept
+{
+    return Capacity - m_numberOfFreeIndices;
+}
+
+template <typename T, uint64_t Capacity>
+typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::begin() noexcept
+{
+    return Iterator(this, findOccupiedSlot(0U));
 }
 
 template <typename T, uint64_t Capacity>
-cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content()
+typename FixedPositionContainer<T, Capacity>::Iterator FixedPositionContainer<T, Capacity>::end() noexcept
 {
-    cxx::vector<T*, Capacity> returnValue;
-    for (auto& e : m_data)
+    return Iterator(this, Capacity);
+}
+
+template <typename T, uint64_t Capacity>
+typename FixedPositionContainer<T, Capacity>::View FixedPositionContainer<T, Capacity>::view() noexcept
+{
+    return View(*this);
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::findOccupiedSlot(const uint64_t index) const noexcept
+{
+    if (index >= Capacity)
+    {
+        return Capacity;
+    }
+
+    uint64_t wordIndex = index / BITS_PER_WORD;
+    // mask out the slots in front of index
+    uint64_t word = m_occupancy[wordIndex] & (~0ULL << (index % BITS_PER_WORD));
+    while (word == 0U)
     {
-        if (e.has_value())
+        ++wordIndex;
+        if (wordIndex >= NUMBER_OF_WORDS)
         {
-            returnValue.emplace_back(&e.value());
+            return Capacity;
         }
+        word = m_occupancy[wordIndex];
     }
-    return returnValue;
+
+    return wordIndex * BITS_PER_WORD + countTrailingZeros(word);
+}
+
+template <typename T, uint64_t Capacity>
+bool FixedPositionContainer<T, Capacity>::isOccupied(const uint64_t index) const noexcept
+{
+    return (m_occupancy[index / BITS_PER_WORD] & (1ULL << (index % BITS_PER_WORD))) != 0U;
+}
+
+template <typename T, uint64_t Capacity>
+T* FixedPositionContainer<T, Capacity>::elementAt(const uint64_t index) noexcept
+{
+    return reinterpret_cast<T*>(&m_data[index]);
+}
+
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::countTrailingZeros(const uint64_t value) noexcept
+{
+    // value must not be zero; de Bruijn sequence to stay independent of compiler intrinsics
+    constexpr uint64_t DE_BRUIJN_SEQUENCE{0x03f79d71b4cb0a89ULL};
+    constexpr uint8_t DE_BRUIJN_INDEX[64] = {0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,
+                                             62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+                                             63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+                                             46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+    return DE_BRUIJN_INDEX[((value & (~value + 1U)) * DE_BRUIJN_SEQUENCE) >> 58U];
 }
 
 } // namespace roudi
@@ -172,6 +172,9 @@ class ProcessManager : public ProcessManagerInterface
 
     void sendServiceRegistryChangeCounterToProcess(const ProcessName_t& process_name) noexcept override;
 
+    /// @brief Sends the location of the shared memory service registry to the application
+    void sendServiceRegistryDataToProcess(const ProcessName_t& processName) noexcept;
+
   private:
     RouDiProcess* getProcessFromList(const ProcessName_t& name) noexcept;
     void monitorProcesses() noexcept;
@@ -47,7 +47,7 @@ class ServiceRegistry
     const serviceMap_t& getServiceMap() const;
 
   private:
-    mutable serviceMap_t m_serviceMap;
+    serviceMap_t m_serviceMap;
 };
 } // namespace roudi
 } // namespace iox
@@ -72,6 +72,7 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     SERVICE_REGISTRY_CHANGE_COUNTER,
+    SERVICE_REGISTRY_DATA,
     MESSAGE_NOT_SUPPORTED,
     // etc..
     END,
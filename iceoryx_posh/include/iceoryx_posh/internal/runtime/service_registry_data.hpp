@@ -0,0 +1,108 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_SERVICE_REGISTRY_DATA_HPP
+#define IOX_POSH_RUNTIME_SERVICE_REGISTRY_DATA_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint64_t nextPowerOfTwo(const uint64_t value) noexcept
+{
+    uint64_t powerOfTwo{1U};
+    while (powerOfTwo < value)
+    {
+        powerOfTwo <<= 1U;
+    }
+    return powerOfTwo;
+}
+
+/// @brief Fixed capacity hash table of all offered service instances which is located in the management segment.
+///        RouDi is the single writer, applications read it directly without an IPC round trip to RouDi.
+///        Readers are synchronized with a sequence lock, i.e. a lookup is repeated when RouDi modified the table
+///        while it was read. All entries of one service are located in the same probe sequence, which allows
+///        a lookup with the AnyInstanceString wildcard without scanning the whole table.
+class ServiceRegistryData
+{
+  public:
+    /// @brief power of two which is at least twice the number of publishers to keep the probe sequences short
+    static constexpr uint64_t CAPACITY = nextPowerOfTwo(2U * MAX_PUBLISHERS);
+
+    ServiceRegistryData() noexcept = default;
+    ServiceRegistryData(const ServiceRegistryData&) = delete;
+    ServiceRegistryData(ServiceRegistryData&&) = delete;
+    ServiceRegistryData& operator=(const ServiceRegistryData&) = delete;
+    ServiceRegistryData& operator=(ServiceRegistryData&&) = delete;
+
+    /// @brief adds a service instance, must only be called by RouDi
+    /// @param[in] service the service string
+    /// @param[in] instance the instance string
+    /// @return false if the table is full, otherwise true; adding an already existing entry is a no-op
+    bool add(const capro::IdString_t& service, const capro::IdString_t& instance) noexcept;
+
+    /// @brief removes a service instance, must only be called by RouDi
+    /// @param[in] service the service string
+    /// @param[in] instance the instance string
+    void remove(const capro::IdString_t& service, const capro::IdString_t& instance) noexcept;
+
+    /// @brief lock-free lookup of all instances of a service, can be called concurrently from any process
+    /// @param[out] instances container which is filled with the matching instances
+    /// @param[in] service the service string
+    /// @param[in] instance the instance string or AnyInstanceString to get all instances of the service
+    /// @return the number of matching instances, which is larger than the size of instances if the container
+    ///         was too small to store all of them
+    uint64_t find(InstanceContainer& instances,
+                  const capro::IdString_t& service,
+                  const capro::IdString_t& instance) const noexcept;
+
+    /// @brief returns a counter which is incremented with every change of the registry, can be used by the
+    ///        applications to check cheaply if a new lookup is required
+    uint64_t changeCounter() const noexcept;
+
+  private:
+    enum class EntryState : uint8_t
+    {
+        EMPTY,
+        USED,
+        DELETED
+    };
+
+    struct Entry
+    {
+        EntryState m_state{EntryState::EMPTY};
+        capro::IdString_t m_service;
+        capro::IdString_t m_instance;
+    };
+
+    static uint64_t hash(const capro::IdString_t& service) noexcept;
+    static uint64_t nextIndex(const uint64_t index) noexcept;
+
+    void beginWrite() noexcept;
+    void endWrite() noexcept;
+
+    /// @brief even if no write is in progress, odd while RouDi modifies the table
+    std::atomic<uint64_t> m_sequence{0U};
+    Entry m_entries[CAPACITY];
+};
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_SERVICE_REGISTRY_DATA_HPP
@@ -58,17 +58,15 @@ class PortPool
 
     virtual ~PortPool() noexcept = default;
 
-    /// @todo don't create the vector with each call but only when the data really change
-    /// there could be a member "cxx::vector<popo::PublisherPortData* m_publisherPorts;" and publisherPorts() would just
-    /// update this member if the publisher ports actually changed
-    cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> getPublisherPortDataList() noexcept;
-    cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getSubscriberPortDataList() noexcept;
-    cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
-    cxx::vector<popo::ApplicationPortData*, MAX_PROCESS_NUMBER> getApplicationPortDataList() noexcept;
-    cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
-    cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
-    getConditionVariableDataList() noexcept;
-    cxx::vector<popo::EventVariableData*, MAX_NUMBER_OF_EVENT_VARIABLES> getEventVariableDataList() noexcept;
+    /// @brief the returned views iterate directly over the port pool without copying the pointers of all elements;
+    ///        removing the current element with the remove methods of the PortPool is allowed during the iteration
+    PortPoolData::PublisherContainer::View getPublisherPortDataList() noexcept;
+    PortPoolData::SubscriberContainer::View getSubscriberPortDataList() noexcept;
+    PortPoolData::InterfaceContainer::View getInterfacePortDataList() noexcept;
+    PortPoolData::ApplicationContainer::View getApplicationPortDataList() noexcept;
+    PortPoolData::NodeContainer::View getNodeDataList() noexcept;
+    PortPoolData::ConditionVariableContainer::View getConditionVariableDataList() noexcept;
+    PortPoolData::EventVariableContainer::View getEventVariableDataList() noexcept;
 
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
@@ -119,6 +117,8 @@ class PortPool
 
     std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
 
+    runtime::ServiceRegistryData* serviceRegistryData() noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
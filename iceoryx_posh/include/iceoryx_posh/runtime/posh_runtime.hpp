@@ -27,6 +27,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_data.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
@@ -87,6 +88,16 @@ class PoshRuntime
     cxx::expected<InstanceContainer, FindServiceError>
     findService(const capro::ServiceDescription& serviceDescription) noexcept;
 
+    /// @brief find all services that match the provided service description in the service registry which RouDi
+    ///        maintains in the shared memory. Other than findService, this does not need a request to RouDi after
+    ///        the first call and does not forward the search to the interfaces like gateways
+    /// @param[in] serviceDescription service to search for, the instance can be AnyInstanceString
+    /// @return cxx::expected<InstanceContainer, FindServiceError>
+    /// InstanceContainer: on success, container that is filled with all matching instances
+    /// FindServiceError: if any, encountered during the operation
+    cxx::expected<InstanceContainer, FindServiceError>
+    lookupService(const capro::ServiceDescription& serviceDescription) noexcept;
+
     /// @brief offer the provided service, sends the offer from application to RouDi daemon
     /// @param[in] serviceDescription service to offer
     /// @return bool, if service is offered returns true else false
@@ -203,6 +214,9 @@ class PoshRuntime
     cxx::expected<popo::EventVariableData*, IpcMessageErrorType>
     requestEventVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    /// @brief requests the location of the service registry from RouDi on the first call
+    const ServiceRegistryData* getServiceRegistryData() noexcept;
+
     /// @brief checks the given application name for certain constraints like length or if is empty
     const ProcessName_t& verifyInstanceName(cxx::optional<const ProcessName_t*> name) noexcept;
 
@@ -214,6 +228,7 @@ class PoshRuntime
     // Shared memory interface for POSIX IPC from RouDi
     SharedMemoryUser m_ShmInterface;
     popo::ApplicationPort m_applicationPort;
+    std::atomic<const ServiceRegistryData*> m_serviceRegistryData{nullptr};
 
     void sendKeepAlive() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
@@ -605,6 +605,11 @@ const std::atomic<uint64_t>* PortManager::serviceRegistryChangeCounter() noexcep
     return m_portPool->serviceRegistryChangeCounter();
 }
 
+const runtime::ServiceRegistryData* PortManager::serviceRegistryData() noexcept
+{
+    return m_portPool->serviceRegistryData();
+}
+
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       const popo::PublisherOptions& publisherOptions,
@@ -702,6 +707,11 @@ void PortManager::addEntryToServiceRegistry(const capro::IdString_t& service,
                                             const capro::IdString_t& instance) noexcept
 {
     m_serviceRegistry.add(service, instance);
+    if (!m_portPool->serviceRegistryData()->add(service, instance))
+    {
+        LogWarn() << "Service '" << service << "' with instance '" << instance
+                  << "' could not be added to the shared memory service registry since it is full.";
+    }
     m_portPool->serviceRegistryChangeCounter()->fetch_add(1, std::memory_order_relaxed);
 }
 
@@ -709,6 +719,7 @@ void PortManager::removeEntryFromServiceRegistry(const capro::IdString_t& servic
                                                  const capro::IdString_t& instance) noexcept
 {
     m_serviceRegistry.remove(service, instance);
+    m_portPool->serviceRegistryData()->remove(service, instance);
     m_portPool->serviceRegistryChangeCounter()->fetch_add(1, std::memory_order_relaxed);
 }
 
@@ -28,30 +28,29 @@ PortPool::PortPool(PortPoolData& portPoolData) noexcept
 {
 }
 
-cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> PortPool::getInterfacePortDataList() noexcept
+PortPoolData::InterfaceContainer::View PortPool::getInterfacePortDataList() noexcept
 {
-    return m_portPoolData->m_interfacePortMembers.content();
+    return m_portPoolData->m_interfacePortMembers.view();
 }
 
-cxx::vector<popo::ApplicationPortData*, MAX_PROCESS_NUMBER> PortPool::getApplicationPortDataList() noexcept
+PortPoolData::ApplicationContainer::View PortPool::getApplicationPortDataList() noexcept
 {
-    return m_portPoolData->m_applicationPortMembers.content();
+    return m_portPoolData->m_applicationPortMembers.view();
 }
 
-cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getNodeDataList() noexcept
+PortPoolData::NodeContainer::View PortPool::getNodeDataList() noexcept
 {
-    return m_portPoolData->m_nodeMembers.content();
+    return m_portPoolData->m_nodeMembers.view();
 }
 
-cxx::vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
-PortPool::getConditionVariableDataList() noexcept
+PortPoolData::ConditionVariableContainer::View PortPool::getConditionVariableDataList() noexcept
 {
-    return m_portPoolData->m_conditionVariableMembers.content();
+    return m_portPoolData->m_conditionVariableMembers.view();
 }
 
-cxx::vector<popo::EventVariableData*, MAX_NUMBER_OF_EVENT_VARIABLES> PortPool::getEventVariableDataList() noexcept
+PortPoolData::EventVariableContainer::View PortPool::getEventVariableDataList() noexcept
 {
-    return m_portPoolData->m_eventVariableMembers.content();
+    return m_portPoolData->m_eventVariableMembers.view();
 }
 
 cxx::expected<popo::InterfacePortData*, PortPoolError>
@@ -160,14 +159,19 @@ std::atomic<uint64_t>* PortPool::serviceRegistryChangeCounter() noexcept
     return &m_portPoolData->m_serviceRegistryChangeCounter;
 }
 
-cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
+runtime::ServiceRegistryData* PortPool::serviceRegistryData() noexcept
 {
-    return m_portPoolData->m_publisherPortMembers.content();
+    return &m_portPoolData->m_serviceRegistryData;
 }
 
-cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSubscriberPortDataList() noexcept
+PortPoolData::PublisherContainer::View PortPool::getPublisherPortDataList() noexcept
 {
-    return m_portPoolData->m_subscriberPortMembers.content();
+    return m_portPoolData->m_publisherPortMembers.view();
+}
+
+PortPoolData::SubscriberContainer::View PortPool::getSubscriberPortDataList() noexcept
+{
+    return m_portPoolData->m_subscriberPortMembers.view();
 }
 
 cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
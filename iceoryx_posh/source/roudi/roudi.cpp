@@ -165,6 +165,11 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         m_prcMgr.sendServiceRegistryChangeCounterToProcess(processName);
         break;
     }
+    case runtime::IpcMessageType::SERVICE_REGISTRY_DATA:
+    {
+        m_prcMgr.sendServiceRegistryDataToProcess(processName);
+        break;
+    }
     case runtime::IpcMessageType::REG:
     {
         if (message.getNumberOfElements() != 6)
@@ -550,6 +550,25 @@ void ProcessManager::sendServiceRegistryChangeCounterToProcess(const ProcessName
     }
 }
 
+void ProcessManager::sendServiceRegistryDataToProcess(const ProcessName_t& processName) noexcept
+{
+    std::lock_guard<std::mutex> g(m_mutex);
+    RouDiProcess* process = getProcessFromList(processName);
+    if (nullptr != process)
+    {
+        // send registry to app as a serialized relative pointer
+        auto offset = RelativePointer::getOffset(m_mgmtSegmentId, m_portManager.serviceRegistryData());
+
+        runtime::IpcMessage sendBuffer;
+        sendBuffer << std::to_string(offset) << std::to_string(m_mgmtSegmentId);
+        process->sendViaIpcChannel(sendBuffer);
+    }
+    else
+    {
+        LogWarn() << "Unknown application " << processName << " requested the service registry.";
+    }
+}
+
 void ProcessManager::addApplicationForProcess(const ProcessName_t& name) noexcept
 {
     std::lock_guard<std::mutex> g(m_mutex);
@@ -34,16 +34,23 @@ void ServiceRegistry::find(InstanceSet_t& instances,
                            const CaproIdString_t& service,
                            const CaproIdString_t& instance) const
 {
+    // do not use operator[] since this would add an entry for every unknown service
+    auto serviceEntry = m_serviceMap.find(service);
+    if (serviceEntry == m_serviceMap.end())
+    {
+        return;
+    }
+
+    auto& instanceSet = serviceEntry->second.instanceSet;
     if (instance == iox::cxx::string<100>(capro::AnyInstanceString))
     {
-        for (auto& instance : m_serviceMap[service].instanceSet)
+        for (auto& instance : instanceSet)
         {
             instances.push_back(instance);
         }
     }
     else
     {
-        auto& instanceSet = m_serviceMap[service].instanceSet;
         auto iter = std::find(instanceSet.begin(), instanceSet.end(), instance);
         if (iter != instanceSet.end())
         {
@@ -148,6 +148,34 @@ const std::atomic<uint64_t>* PoshRuntime::getServiceRegistryChangeCounter() noex
     }
 }
 
+const ServiceRegistryData* PoshRuntime::getServiceRegistryData() noexcept
+{
+    auto serviceRegistryData = m_serviceRegistryData.load(std::memory_order_acquire);
+    if (serviceRegistryData != nullptr)
+    {
+        return serviceRegistryData;
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::SERVICE_REGISTRY_DATA) << m_appName;
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (2U == receiveBuffer.getNumberOfElements()))
+    {
+        RelativePointer::offset_t offset{0U};
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(0U).c_str(), offset);
+        RelativePointer::id_t segmentId{0U};
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), segmentId);
+        serviceRegistryData = reinterpret_cast<const ServiceRegistryData*>(RelativePointer::getPtr(segmentId, offset));
+
+        m_serviceRegistryData.store(serviceRegistryData, std::memory_order_release);
+        return serviceRegistryData;
+    }
+
+    LogError() << "unable to request service registry caused by wrong response from RouDi: \""
+               << receiveBuffer.getMessage() << "\" with request: \"" << sendBuffer.getMessage() << "\"";
+    return nullptr;
+}
+
 PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const capro::ServiceDescription& service,
                                                                          const popo::PublisherOptions& publisherOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
@@ -444,6 +472,30 @@ PoshRuntime::findService(const capro::ServiceDescription& serviceDescription) no
     return {cxx::success<InstanceContainer>(instanceContainer)};
 }
 
+cxx::expected<InstanceContainer, FindServiceError>
+PoshRuntime::lookupService(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    auto serviceRegistryData = getServiceRegistryData();
+    if (serviceRegistryData == nullptr)
+    {
+        errorHandler(Error::kIPC_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_CHANNEL, nullptr, ErrorLevel::MODERATE);
+        return cxx::error<FindServiceError>(FindServiceError::UNABLE_TO_WRITE_TO_ROUDI_CHANNEL);
+    }
+
+    InstanceContainer instanceContainer;
+    auto numberOfInstances = serviceRegistryData->find(
+        instanceContainer, serviceDescription.getServiceIDString(), serviceDescription.getInstanceIDString());
+
+    if (numberOfInstances > instanceContainer.capacity())
+    {
+        LogWarn() << numberOfInstances << " instances found for service \"" << serviceDescription.getServiceIDString()
+                  << "\" which is more than supported number of instances(" << MAX_NUMBER_OF_INSTANCES << "\n";
+        errorHandler(Error::kPOSH__SERVICE_DISCOVERY_INSTANCE_CONTAINER_OVERFLOW, nullptr, ErrorLevel::MODERATE);
+        return cxx::error<FindServiceError>(FindServiceError::INSTANCE_CONTAINER_OVERFLOW);
+    }
+    return {cxx::success<InstanceContainer>(instanceContainer)};
+}
+
 
 bool PoshRuntime::offerService(const capro::ServiceDescription& serviceDescription) noexcept
 {
@@ -0,0 +1,189 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/service_registry_data.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint64_t ServiceRegistryData::CAPACITY;
+
+bool ServiceRegistryData::add(const capro::IdString_t& service, const capro::IdString_t& instance) noexcept
+{
+    // RouDi is the only writer, therefore the table can be read without the sequence lock here
+    uint64_t freeIndex{CAPACITY};
+    uint64_t index = hash(service);
+    for (uint64_t i = 0U; i < CAPACITY; ++i, index = nextIndex(index))
+    {
+        auto& entry = m_entries[index];
+        if (entry.m_state == EntryState::USED)
+        {
+            if (entry.m_service == service && entry.m_instance == instance)
+            {
+                return true;
+            }
+            continue;
+        }
+
+        if (freeIndex == CAPACITY)
+        {
+            freeIndex = index;
+        }
+
+        if (entry.m_state == EntryState::EMPTY)
+        {
+            // end of the probe sequence, the entry does not yet exist
+            break;
+        }
+    }
+
+    if (freeIndex == CAPACITY)
+    {
+        return false;
+    }
+
+    beginWrite();
+    auto& entry = m_entries[freeIndex];
+    entry.m_service = service;
+    entry.m_instance = instance;
+    entry.m_state = EntryState::USED;
+    endWrite();
+
+    return true;
+}
+
+void ServiceRegistryData::remove(const capro::IdString_t& service, const capro::IdString_t& instance) noexcept
+{
+    uint64_t index = hash(service);
+    for (uint64_t i = 0U; i < CAPACITY; ++i, index = nextIndex(index))
+    {
+        auto& entry = m_entries[index];
+        if (entry.m_state == EntryState::EMPTY)
+        {
+            return;
+        }
+
+        if (entry.m_state == EntryState::USED && entry.m_service == service && entry.m_instance == instance)
+        {
+            beginWrite();
+            if (m_entries[nextIndex(index)].m_state == EntryState::EMPTY)
+            {
+                // the entry is the end of a probe sequence, therefore it and all directly preceding tombstones
+                // can be released to prevent the table from filling up with tombstones
+                entry.m_state = EntryState::EMPTY;
+                uint64_t previous = (index + CAPACITY - 1U) & (CAPACITY - 1U);
+                for (uint64_t j = 0U; j < CAPACITY && m_entries[previous].m_state == EntryState::DELETED; ++j)
+                {
+                    m_entries[previous].m_state = EntryState::EMPTY;
+                    previous = (previous + CAPACITY - 1U) & (CAPACITY - 1U);
+                }
+            }
+            else
+            {
+                entry.m_state = EntryState::DELETED;
+            }
+            endWrite();
+            return;
+        }
+    }
+}
+
+uint64_t ServiceRegistryData::find(InstanceContainer& instances,
+                                   const capro::IdString_t& service,
+                                   const capro::IdString_t& instance) const noexcept
+{
+    const bool isAnyInstance = (instance == capro::IdString_t(capro::AnyInstanceString));
+
+    while (true)
+    {
+        const uint64_t sequenceBefore = m_sequence.load(std::memory_order_acquire);
+        if ((sequenceBefore & 1U) != 0U)
+        {
+            // RouDi is currently writing
+            continue;
+        }
+
+        instances.clear();
+        uint64_t numberOfMatches{0U};
+        uint64_t index = hash(service);
+        for (uint64_t i = 0U; i < CAPACITY; ++i, index = nextIndex(index))
+        {
+            const auto& entry = m_entries[index];
+            if (entry.m_state == EntryState::EMPTY)
+            {
+                break;
+            }
+
+            if (entry.m_state == EntryState::USED && entry.m_service == service
+                && (isAnyInstance || entry.m_instance == instance))
+            {
+                ++numberOfMatches;
+                if (instances.size() < instances.capacity())
+                {
+                    instances.push_back(entry.m_instance);
+                }
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequenceBefore == m_sequence.load(std::memory_order_relaxed))
+        {
+            return numberOfMatches;
+        }
+    }
+}
+
+uint64_t ServiceRegistryData::changeCounter() const noexcept
+{
+    return m_sequence.load(std::memory_order_acquire) / 2U;
+}
+
+uint64_t ServiceRegistryData::hash(const capro::IdString_t& service) noexcept
+{
+    // FNV-1a
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t value{FNV_OFFSET_BASIS};
+    const char* data = service.c_str();
+    for (uint64_t i = 0U; i < service.size(); ++i)
+    {
+        value ^= static_cast<uint8_t>(data[i]);
+        value *= FNV_PRIME;
+    }
+    return value & (CAPACITY - 1U);
+}
+
+uint64_t ServiceRegistryData::nextIndex(const uint64_t index) noexcept
+{
+    return (index + 1U) & (CAPACITY - 1U);
+}
+
+void ServiceRegistryData::beginWrite() noexcept
+{
+    m_sequence.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void ServiceRegistryData::endWrite() noexcept
+{
+    m_sequence.fetch_add(1U, std::memory_order_release);
+}
+
+} // namespace runtime
+} // namespace iox
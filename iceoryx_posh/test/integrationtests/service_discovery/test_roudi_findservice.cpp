@@ -396,3 +396,61 @@ TEST_F(RoudiFindService_test, findServiceInstanceContainerOverflowError)
 
     ASSERT_THAT(instanceContainer.has_error(), Eq(true));
 }
+
+TEST_F(RoudiFindService_test, LookupServiceFindsOfferedInstance)
+{
+    senderRuntime->offerService({"service1", "instance1"});
+    senderRuntime->offerService({"service1", "instance2"});
+    this->InterOpWait();
+
+    auto instanceContainer = receiverRuntime->lookupService({"service1", "instance2"});
+
+    ASSERT_THAT(instanceContainer.has_error(), Eq(false));
+    ASSERT_THAT(instanceContainer.value().size(), Eq(1u));
+    EXPECT_THAT(*instanceContainer.value().begin(), Eq(IdString_t("instance2")));
+}
+
+TEST_F(RoudiFindService_test, LookupServiceWithAnyInstanceFindsAllInstances)
+{
+    senderRuntime->offerService({"service1", "instance1"});
+    senderRuntime->offerService({"service1", "instance2"});
+    senderRuntime->offerService({"service2", "instance3"});
+    this->InterOpWait();
+    InstanceContainer instanceContainerExp;
+    InitContainer(instanceContainerExp, {"instance1", "instance2"});
+
+    auto instanceContainer = receiverRuntime->lookupService({"service1", iox::capro::AnyInstanceString});
+
+    ASSERT_THAT(instanceContainer.has_error(), Eq(false));
+    EXPECT_TRUE(instanceContainer.value() == instanceContainerExp);
+}
+
+TEST_F(RoudiFindService_test, LookupServiceDoesNotFindStoppedService)
+{
+    senderRuntime->offerService({"service1", "instance1"});
+    this->InterOpWait();
+    auto changeCounter = receiverRuntime->getServiceRegistryChangeCounter()->load();
+
+    senderRuntime->stopOfferService({"service1", "instance1"});
+    this->InterOpWait();
+
+    EXPECT_THAT(receiverRuntime->getServiceRegistryChangeCounter()->load(), Gt(changeCounter));
+    auto instanceContainer = receiverRuntime->lookupService({"service1", "instance1"});
+    ASSERT_THAT(instanceContainer.has_error(), Eq(false));
+    EXPECT_THAT(instanceContainer.value().size(), Eq(0u));
+}
+
+TEST_F(RoudiFindService_test, LookupServiceInstanceContainerOverflowError)
+{
+    for (size_t i = 0; i < iox::MAX_NUMBER_OF_INSTANCES + 1; i++)
+    {
+        std::string instance = "i" + std::to_string(i);
+        senderRuntime->offerService({"s", IdString_t(iox::cxx::TruncateToCapacity, instance)});
+        this->InterOpWait();
+    }
+
+    auto instanceContainer = receiverRuntime->lookupService({"s", iox::capro::AnyInstanceString});
+
+    ASSERT_THAT(instanceContainer.has_error(), Eq(true));
+    EXPECT_THAT(instanceContainer.get_error(), Eq(iox::runtime::FindServiceError::INSTANCE_CONTAINER_OVERFLOW));
+}
@@ -0,0 +1,180 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_data.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using iox::capro::IdString_t;
+using iox::runtime::ServiceRegistryData;
+
+class ServiceRegistryData_test : public Test
+{
+  public:
+    ServiceRegistryData sut;
+    iox::runtime::InstanceContainer searchResults;
+    IdString_t anyInstance{iox::capro::AnyInstanceString};
+};
+
+TEST_F(ServiceRegistryData_test, FindInEmptyRegistryReturnsNothing)
+{
+    EXPECT_THAT(sut.find(searchResults, "a", anyInstance), Eq(0U));
+    EXPECT_THAT(searchResults.size(), Eq(0U));
+}
+
+TEST_F(ServiceRegistryData_test, SingleAddCanBeFound)
+{
+    EXPECT_TRUE(sut.add("a", "b"));
+
+    EXPECT_THAT(sut.find(searchResults, "a", "b"), Eq(1U));
+    ASSERT_THAT(searchResults.size(), Eq(1U));
+    EXPECT_THAT(searchResults[0], Eq(IdString_t("b")));
+}
+
+TEST_F(ServiceRegistryData_test, AddingSameEntryTwiceResultsInOneEntry)
+{
+    EXPECT_TRUE(sut.add("a", "b"));
+    EXPECT_TRUE(sut.add("a", "b"));
+
+    EXPECT_THAT(sut.find(searchResults, "a", anyInstance), Eq(1U));
+}
+
+TEST_F(ServiceRegistryData_test, FindWithAnyInstanceReturnsAllInstancesOfService)
+{
+    sut.add("a", "b");
+    sut.add("a", "c");
+    sut.add("x", "b");
+    sut.add("a", "d");
+
+    EXPECT_THAT(sut.find(searchResults, "a", anyInstance), Eq(3U));
+    ASSERT_THAT(searchResults.size(), Eq(3U));
+    EXPECT_THAT(searchResults[0], Eq(IdString_t("b")));
+    EXPECT_THAT(searchResults[1], Eq(IdString_t("c")));
+    EXPECT_THAT(searchResults[2], Eq(IdString_t("d")));
+}
+
+TEST_F(ServiceRegistryData_test, FindOfUnknownInstanceReturnsNothing)
+{
+    sut.add("a", "b");
+
+    EXPECT_THAT(sut.find(searchResults, "a", "c"), Eq(0U));
+    EXPECT_THAT(sut.find(searchResults, "c", "b"), Eq(0U));
+    EXPECT_THAT(searchResults.size(), Eq(0U));
+}
+
+TEST_F(ServiceRegistryData_test, RemovedEntryCannotBeFound)
+{
+    sut.add("a", "b");
+    sut.add("a", "c");
+    sut.remove("a", "b");
+
+    EXPECT_THAT(sut.find(searchResults, "a", anyInstance), Eq(1U));
+    ASSERT_THAT(searchResults.size(), Eq(1U));
+    EXPECT_THAT(searchResults[0], Eq(IdString_t("c")));
+}
+
+TEST_F(ServiceRegistryData_test, RemovingUnknownEntryHasNoEffect)
+{
+    sut.add("a", "b");
+    auto counter = sut.changeCounter();
+
+    sut.remove("a", "c");
+    sut.remove("c", "b");
+
+    EXPECT_THAT(sut.changeCounter(), Eq(counter));
+    EXPECT_THAT(sut.find(searchResults, "a", anyInstance), Eq(1U));
+}
+
+TEST_F(ServiceRegistryData_test, ChangeCounterIsIncreasedOnModification)
+{
+    auto counter = sut.changeCounter();
+    sut.add("a", "b");
+    EXPECT_THAT(sut.changeCounter(), Eq(counter + 1U));
+    sut.remove("a", "b");
+    EXPECT_THAT(sut.changeCounter(), Eq(counter + 2U));
+}
+
+TEST_F(ServiceRegistryData_test, FindReportsAllMatchesWhenContainerOverflows)
+{
+    constexpr uint64_t NUMBER_OF_INSTANCES = iox::MAX_NUMBER_OF_INSTANCES + 1U;
+    for (uint64_t i = 0U; i < NUMBER_OF_INSTANCES; ++i)
+    {
+        sut.add("a", IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i)));
+    }
+
+    EXPECT_THAT(sut.find(searchResults, "a", anyInstance), Eq(NUMBER_OF_INSTANCES));
+    EXPECT_THAT(searchResults.size(), Eq(iox::MAX_NUMBER_OF_INSTANCES));
+}
+
+TEST_F(ServiceRegistryData_test, RegistryCanBeFilledUpToCapacity)
+{
+    for (uint64_t i = 0U; i < ServiceRegistryData::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.add(IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i)), "i"));
+    }
+    EXPECT_FALSE(sut.add("full", "i"));
+
+    sut.remove("0", "i");
+    EXPECT_TRUE(sut.add("full", "i"));
+    EXPECT_THAT(sut.find(searchResults, "full", "i"), Eq(1U));
+}
+
+TEST_F(ServiceRegistryData_test, RepeatedAddAndRemoveDoesNotExhaustRegistry)
+{
+    for (uint64_t i = 0U; i < 4U * ServiceRegistryData::CAPACITY; ++i)
+    {
+        auto service = IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i));
+        ASSERT_TRUE(sut.add(service, "i"));
+        sut.remove(service, "i");
+    }
+
+    EXPECT_TRUE(sut.add("a", "b"));
+    EXPECT_THAT(sut.find(searchResults, "a", "b"), Eq(1U));
+}
+
+TEST_F(ServiceRegistryData_test, ConcurrentFindWhileModifyingReturnsConsistentResults)
+{
+    sut.add("stable", "instance");
+    std::atomic_bool keepRunning{true};
+
+    std::thread writer([&] {
+        uint64_t i = 0U;
+        while (keepRunning.load())
+        {
+            auto instance = IdString_t(iox::cxx::TruncateToCapacity, std::to_string(i++ % 10U));
+            sut.add("volatile", instance);
+            sut.remove("volatile", instance);
+        }
+    });
+
+    for (uint64_t i = 0U; i < 10000U; ++i)
+    {
+        ASSERT_THAT(sut.find(searchResults, "stable", anyInstance), Eq(1U));
+        ASSERT_THAT(searchResults[0], Eq(IdString_t("instance")));
+    }
+
+    keepRunning = false;
+    writer.join();
+}
+
+} // namespace
@@ -0,0 +1,306 @@
+// Copyright (c) 2021 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::roudi::FixedPositionContainer;
+
+struct Element
+{
+    Element(const uint64_t value, uint64_t& destructorCalls)
+        : m_value(value)
+        , m_destructorCalls(destructorCalls)
+    {
+    }
+
+    ~Element()
+    {
+        ++m_destructorCalls;
+    }
+
+    uint64_t m_value;
+    uint64_t& m_destructorCalls;
+};
+
+class FixedPositionContainer_test : public Test
+{
+  public:
+    /// @brief not a multiple of 64 to cover a partially used last word of the occupancy bitmap
+    static constexpr uint64_t CAPACITY = 130U;
+
+    template <typename Container>
+    std::vector<uint64_t> values(Container& container)
+    {
+        std::vector<uint64_t> result;
+        for (auto element : container)
+        {
+            result.push_back(element->m_value);
+        }
+        return result;
+    }
+
+    uint64_t destructorCalls{0U};
+    FixedPositionContainer<Element, CAPACITY> sut;
+};
+
+constexpr uint64_t FixedPositionContainer_test::CAPACITY;
+
+TEST_F(FixedPositionContainer_test, NewContainerIsEmpty)
+{
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.hasFreeSpace());
+    EXPECT_TRUE(sut.begin() == sut.end());
+}
+
+TEST_F(FixedPositionContainer_test, InsertedElementCanBeIterated)
+{
+    auto element = sut.insert(42U, destructorCalls);
+
+    ASSERT_THAT(element, Ne(nullptr));
+    EXPECT_THAT(sut.size(), Eq(1U));
+    ASSERT_TRUE(sut.begin() != sut.end());
+    EXPECT_THAT(*sut.begin(), Eq(element));
+    EXPECT_THAT(values(sut), ElementsAre(42U));
+}
+
+TEST_F(FixedPositionContainer_test, IterationIsInInsertionOrderForFreshContainer)
+{
+    for (uint64_t i = 0U; i < 5U; ++i)
+    {
+        sut.insert(i, destructorCalls);
+    }
+
+    EXPECT_THAT(values(sut), ElementsAre(0U, 1U, 2U, 3U, 4U));
+}
+
+TEST_F(FixedPositionContainer_test, InsertUntilFullSucceedsAndFurtherInsertFails)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(sut.insert(i, destructorCalls), Ne(nullptr));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+    EXPECT_FALSE(sut.hasFreeSpace());
+    EXPECT_THAT(sut.insert(CAPACITY, destructorCalls), Eq(nullptr));
+    EXPECT_THAT(values(sut).size(), Eq(CAPACITY));
+}
+
+TEST_F(FixedPositionContainer_test, EraseCallsDestructorAndFreesSlot)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        sut.insert(i, destructorCalls);
+    }
+    auto element = *sut.begin();
+
+    sut.erase(element);
+
+    EXPECT_THAT(destructorCalls, Eq(1U));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY - 1U));
+    EXPECT_TRUE(sut.hasFreeSpace());
+    EXPECT_THAT(sut.insert(1000U, destructorCalls), Eq(element));
+}
+
+TEST_F(FixedPositionContainer_test, ErasingElementTwiceIsIgnored)
+{
+    auto element = sut.insert(1U, destructorCalls);
+    sut.insert(2U, destructorCalls);
+
+    sut.erase(element);
+    sut.erase(element);
+
+    EXPECT_THAT(destructorCalls, Eq(1U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(FixedPositionContainer_test, ErasingForeignPointerIsIgnored)
+{
+    sut.insert(1U, destructorCalls);
+    uint64_t foreignDestructorCalls{0U};
+    Element foreign(2U, foreignDestructorCalls);
+
+    sut.erase(&foreign);
+    sut.erase(nullptr);
+
+    EXPECT_THAT(destructorCalls, Eq(0U));
+    EXPECT_THAT(sut.size(), Eq(1U));
+}
+
+TEST_F(FixedPositionContainer_test, IterationSkipsErasedSlotsAcrossWordBoundaries)
+{
+    std::vector<Element*> elements;
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        elements.push_back(sut.insert(i, destructorCalls));
+    }
+
+    std::vector<uint64_t> expectedValues;
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        if (i == 0U || i == 63U || i == 64U || i == 128U || i == CAPACITY - 1U)
+        {
+            expectedValues.push_back(i);
+        }
+        else
+        {
+            sut.erase(elements[i]);
+        }
+    }
+
+    EXPECT_THAT(values(sut), ContainerEq(expectedValues));
+}
+
+TEST_F(FixedPositionContainer_test, ErasingCurrentElementDuringIterationVisitsAllElements)
+{
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        sut.insert(i, destructorCalls);
+    }
+
+    uint64_t numberOfVisits{0U};
+    for (auto element : sut)
+    {
+        ++numberOfVisits;
+        sut.erase(element);
+    }
+
+    EXPECT_THAT(numberOfVisits, Eq(CAPACITY));
+    EXPECT_THAT(destructorCalls, Eq(CAPACITY));
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_TRUE(sut.begin() == sut.end());
+}
+
+TEST_F(FixedPositionContainer_test, InsertReusesMostRecentlyErasedSlotFirst)
+{
+    std::vector<Element*> elements;
+    for (uint64_t i = 0U; i < 4U; ++i)
+    {
+        elements.push_back(sut.insert(i, destructorCalls));
+    }
+
+    sut.erase(elements[1U]);
+    sut.erase(elements[2U]);
+
+    EXPECT_THAT(sut.insert(10U, destructorCalls), Eq(elements[2U]));
+    EXPECT_THAT(sut.insert(11U, destructorCalls), Eq(elements[1U]));
+    EXPECT_THAT(values(sut), ElementsAre(0U, 11U, 10U, 3U));
+}
+
+TEST_F(FixedPositionContainer_test, ElementInsertedBehindIteratorDuringIterationIsVisited)
+{
+    sut.insert(0U, destructorCalls);
+
+    std::vector<uint64_t> visitedValues;
+    for (auto element : sut)
+    {
+        visitedValues.push_back(element->m_value);
+        if (element->m_value == 0U)
+        {
+            sut.insert(1U, destructorCalls);
+        }
+    }
+
+    EXPECT_THAT(visitedValues, ElementsAre(0U, 1U));
+}
+
+TEST_F(FixedPositionContainer_test, ElementInsertedInFrontOfIteratorDuringIterationIsNotVisited)
+{
+    auto first = sut.insert(0U, destructorCalls);
+    sut.insert(1U, destructorCalls);
+    sut.erase(first);
+
+    std::vector<uint64_t> visitedValues;
+    for (auto element : sut)
+    {
+        visitedValues.push_back(element->m_value);
+        sut.insert(2U, destructorCalls);
+    }
+
+    EXPECT_THAT(visitedValues, ElementsAre(1U));
+}
+
+TEST_F(FixedPositionContainer_test, IteratorCanBeUsedWithStandardAlgorithms)
+{
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        sut.insert(i, destructorCalls);
+    }
+
+    auto view = sut.view();
+    EXPECT_THAT(std::distance(view.begin(), view.end()), Eq(10));
+    EXPECT_THAT(std::count_if(view.begin(), view.end(), [](Element* element) { return element->m_value % 2U == 0U; }),
+                Eq(5));
+    auto found =
+        std::find_if(view.begin(), view.end(), [](Element* element) { return element->m_value == 7U; });
+    ASSERT_TRUE(found != view.end());
+    EXPECT_THAT((*found)->m_value, Eq(7U));
+}
+
+TEST_F(FixedPositionContainer_test, ViewReflectsChangesOfTheContainer)
+{
+    auto view = sut.view();
+    EXPECT_THAT(view.size(), Eq(0U));
+
+    auto element = sut.insert(3U, destructorCalls);
+    EXPECT_THAT(view.size(), Eq(1U));
+    EXPECT_THAT(values(view), ElementsAre(3U));
+
+    sut.erase(element);
+    EXPECT_TRUE(view.begin() == view.end());
+}
+
+TEST_F(FixedPositionContainer_test, CapacityLargerThanUint8RangeCanBeFilled)
+{
+    constexpr uint64_t LARGE_CAPACITY{300U};
+    FixedPositionContainer<Element, LARGE_CAPACITY> container;
+    for (uint64_t i = 0U; i < LARGE_CAPACITY; ++i)
+    {
+        ASSERT_THAT(container.insert(i, destructorCalls), Ne(nullptr));
+    }
+    EXPECT_FALSE(container.hasFreeSpace());
+
+    auto last = *std::next(container.begin(), LARGE_CAPACITY - 1U);
+    EXPECT_THAT(last->m_value, Eq(LARGE_CAPACITY - 1U));
+    container.erase(last);
+    EXPECT_THAT(container.insert(1000U, destructorCalls), Eq(last));
+}
+
+TEST_F(FixedPositionContainer_test, DestructorDestroysRemainingElements)
+{
+    uint64_t calls{0U};
+    {
+        FixedPositionContainer<Element, 3U> container;
+        auto element = container.insert(1U, calls);
+        container.insert(2U, calls);
+        container.insert(3U, calls);
+        container.erase(element);
+        EXPECT_THAT(calls, Eq(1U));
+    }
+    EXPECT_THAT(calls, Eq(3U));
+}
+
+} // namespace
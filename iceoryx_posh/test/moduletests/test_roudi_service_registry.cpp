@@ -191,3 +191,12 @@ TEST_F(ServiceRegistry_test, GetServiceMap)
 
     EXPECT_THAT(mapA && mapE, Eq(true));
 }
+
+TEST_F(ServiceRegistry_test, FindOfUnknownServiceDoesNotAddEntry)
+{
+    registry.find(searchResults, "a", AnyInstanceString);
+    registry.find(searchResults, "a", "b");
+
+    EXPECT_THAT(searchResults.size(), Eq(0));
+    EXPECT_THAT(registry.getServiceMap().size(), Eq(0));
+}